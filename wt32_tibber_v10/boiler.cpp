@@ -1,11 +1,20 @@
 #include "boiler.h"
 #include "globals.h"
 #include "modbus_helpers.h"
+#include "tibber.h"
 
 static const int RELAY1_REG = 806;
 static const int RELAY2_REG = 807;
 
-void setBoilerPower(int powerLevel) {
+int boilerAutoStage = 0;
+
+// Set by toggleBoilerMode() when switching to Auto, taken by runBoilerAutomation()
+// (both under modbusMutex)
+enum AutoEntry { AUTO_ENTRY_NONE, AUTO_ENTRY_OFF, AUTO_ENTRY_UNKNOWN };
+static AutoEntry autoEntry = AUTO_ENTRY_NONE;
+
+// Must be called with modbusMutex held
+static bool writeBoilerRelays(int powerLevel) {
     uint16_t r1 = 0, r2 = 0;
     switch (powerLevel) {
         case 2: r1 = 1; r2 = 0; break;
@@ -13,11 +22,17 @@ void setBoilerPower(int powerLevel) {
         case 6: r1 = 1; r2 = 1; break;
         default: r1 = 0; r2 = 0; break;  // 0 = off/auto
     }
-    
+
+    bool ok = writeModbusData(remoteCERBO, RELAY1_REG, r1, CERBO_UNIT_ID_VAL);
+    ok = writeModbusData(remoteCERBO, RELAY2_REG, r2, CERBO_UNIT_ID_VAL) && ok;
+    return ok;
+}
+
+bool setBoilerPower(int powerLevel) {
     xSemaphoreTake(modbusMutex, portMAX_DELAY);
-    writeModbusData(remoteCERBO, RELAY1_REG, r1, CERBO_UNIT_ID_VAL);
-    writeModbusData(remoteCERBO, RELAY2_REG, r2, CERBO_UNIT_ID_VAL);
+    bool ok = writeBoilerRelays(powerLevel);
     xSemaphoreGive(modbusMutex);
+    return ok;
 }
 
 void syncBoilerStatus() {
@@ -43,10 +58,95 @@ void toggleBoilerMode() {
     for (int i = 0; i < numModes; i++) {
         if (modes[i] == boilerMode) { currentIndex = i; break; }
     }
-    boilerMode = modes[(currentIndex + 1) % numModes];
-    
-    // Non-blocking: just set the power, don't delay
-    setBoilerPower(boilerMode);
-    
-    Serial.printf("Boiler mode changed to: %d\n", boilerMode);
+    int newMode = modes[(currentIndex + 1) % numModes];
+
+    // Mode, relay write and Auto hand-over happen together under the mutex
+    xSemaphoreTake(modbusMutex, portMAX_DELAY);
+    boilerMode = newMode;
+    bool ok = writeBoilerRelays(newMode);
+    if (newMode == 0) autoEntry = ok ? AUTO_ENTRY_OFF : AUTO_ENTRY_UNKNOWN;
+    xSemaphoreGive(modbusMutex);
+
+    Serial.printf("Boiler mode changed to: %d%s\n", newMode, ok ? "" : " (relay write failed)");
+}
+
+
+// ============================================================
+// Auto mode: PV-surplus controller
+// ============================================================
+
+// True if the current hour is one of the BOILER_AUTO_CHEAP_HOURS cheapest of today
+static bool isCheapTibberHour() {
+    int hour = getCurrentHour();
+    if (hour < 0 || hour >= 24) return false;
+
+    bool loaded = false;
+    for (int i = 0; i < 24; i++) {
+        if (tibberPrices[i] != 0.0) { loaded = true; break; }
+    }
+    if (!loaded) return false;
+
+    int cheaper = 0;
+    for (int i = 0; i < 24; i++) {
+        if (tibberPrices[i] < tibberPrices[hour]) cheaper++;
+    }
+    return cheaper < BOILER_AUTO_CHEAP_HOURS;
+}
+
+// Called from modbusTask after the Cerbo poll (modbusMutex not held).
+// powerValid/tempValid: this cycle's Cerbo reads succeeded.
+void runBoilerAutomation(bool powerValid, bool tempValid) {
+    static BoilerAutoState st = BOILER_AUTO_STATE_INIT;
+
+    xSemaphoreTake(modbusMutex, portMAX_DELAY);
+    int mode = boilerMode;
+    AutoEntry entry = autoEntry;
+    autoEntry = AUTO_ENTRY_NONE;
+    xSemaphoreGive(modbusMutex);
+
+    if (entry != AUTO_ENTRY_NONE) {
+        // Manual -> Auto: relays off if toggleBoilerMode() could write them, else unknown
+        BoilerAutoState fresh = BOILER_AUTO_STATE_INIT;
+        st = fresh;
+        st.stage = (entry == AUTO_ENTRY_OFF) ? 0 : -1;
+        st.lastChange = millis();
+        boilerAutoStage = 0;
+    }
+    if (mode != 0) return;
+    if (!cerboConnected) return;
+
+    BoilerAutoInput in;
+    in.gridKW = totalGridPowerKW;
+    in.batteryKW = (int16_t)batteryPower / 1000.0;
+    in.pvKW = (dcPvPower + acPvPower[0] + acPvPower[1] + acPvPower[2]) / 1000.0;
+    in.socPct = PylontechSOC;
+    in.waterTempC = waterTemperature / 100.0;
+    in.powerValid = powerValid;
+    in.tempValid = tempValid;
+    in.cheapHour = isCheapTibberHour();
+    in.now = millis();
+
+    int target = boilerAutoStep(in, st);
+    if (target == st.stage) return;
+
+    // Relays only written when the stage actually changes. Re-check the mode under
+    // the mutex: a manual stage from toggleBoilerMode() must not be overwritten.
+    xSemaphoreTake(modbusMutex, portMAX_DELAY);
+    if (boilerMode != 0) {
+        xSemaphoreGive(modbusMutex);
+        return;
+    }
+    bool ok = writeBoilerRelays(target);
+    xSemaphoreGive(modbusMutex);
+
+    if (!ok) {
+        // Relay state unknown: write again on the next cycle
+        Serial.printf("Boiler auto: relay write for %d kW failed\n", target);
+        st.stage = -1;
+        return;
+    }
+    Serial.printf("Boiler auto: %d -> %d kW (grid=%.2f pv=%.2f soc=%d temp=%.1f)\n",
+                  st.stage, target, in.gridKW, in.pvKW, in.socPct, in.waterTempC);
+    boilerAutoCommit(st, target, in);
+    boilerAutoStage = target;
 }
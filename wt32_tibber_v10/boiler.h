@@ -1,8 +1,14 @@
 #ifndef BOILER_H
 #define BOILER_H
 
+#include "boiler_auto.h"
+
+// Auto mode (boilerMode 0): stage currently driven by the controller (0/2/4/6 kW)
+extern int boilerAutoStage;
+
 void syncBoilerStatus();
-void setBoilerPower(int power);
+bool setBoilerPower(int power);
 void toggleBoilerMode();
+void runBoilerAutomation(bool powerValid, bool tempValid);
 
 #endif
@@ -0,0 +1,162 @@
+#ifndef BOILER_AUTO_H
+#define BOILER_AUTO_H
+
+// PV-surplus controller for boiler Auto mode (boilerMode 0).
+// Pure decision logic without Arduino/FreeRTOS dependencies, so it can be
+// simulated on the host (see test/boiler_auto_test.cpp).
+
+// ============================================================
+// Boiler Automation (mode 0 = Auto)
+// ============================================================
+#define BOILER_AUTO_MARGIN_KW    0.3      // hysteresis around each stage
+#define BOILER_AUTO_MIN_SOC      90       // % Pylontech SOC before battery charge counts as surplus
+#define BOILER_AUTO_MIN_ON_MS    300000   // 5 minutes on a stage before changing it (up or down)
+#define BOILER_AUTO_MIN_OFF_MS   300000   // 5 minutes off before switching on again
+#define BOILER_AUTO_MAX_TEMP_C   65       // water temperature cap
+#define BOILER_AUTO_TEMP_HYST_C  5        // re-enable below cap minus this
+#define BOILER_AUTO_MIN_TEMP_C   45       // below this, heat in cheap Tibber hours
+#define BOILER_AUTO_CHEAP_HOURS  3        // cheapest hours of today used as fallback
+#define BOILER_AUTO_CHEAP_KW     2        // stage used in cheap hours
+#define BOILER_AUTO_CONFIRM_POLLS    3    // polls averaged to see a step's draw on the grid
+#define BOILER_AUTO_CONFIRM_FRACTION 0.5  // share of the step the load must rise by
+
+// Controller inputs for one poll cycle
+struct BoilerAutoInput {
+    float gridKW;         // positive = import, negative = export
+    float batteryKW;      // positive = charging, negative = discharging
+    float pvKW;           // DC + AC PV
+    int   socPct;         // Pylontech SOC
+    float waterTempC;
+    bool  powerValid;     // grid/PV/battery/SOC read successfully this cycle
+    bool  tempValid;      // water temperature read successfully this cycle
+    bool  cheapHour;      // current hour is among the cheapest Tibber hours
+    unsigned long now;    // millis()
+};
+
+struct BoilerAutoState {
+    int stage;                 // kW, -1 = relays unknown (forces next write)
+    unsigned long lastChange;  // millis() of last stage change
+    bool tempCapped;           // water cap reached, waiting for hysteresis
+    bool cheapActive;          // heating in a cheap Tibber hour
+    bool drawConfirmed;        // boiler draws the step above confirmedStage
+    int confirmedStage;        // last stage whose draw was seen on the grid
+    int stepKW;                // stage - confirmedStage being checked, 0 = nothing to check
+    float loadAtChange;        // house + boiler load (grid + PV - battery) before the step
+    float drawHist[BOILER_AUTO_CONFIRM_POLLS];  // measured extra draw, last polls
+    int drawCount;
+};
+
+#define BOILER_AUTO_STATE_INIT {-1, 0, false, false, true, 0, 0, 0.0f, {0}, 0}
+
+// Highest stage that fits into the given power
+inline int boilerStageForPower(float kw) {
+    static const int stages[] = {0, 2, 4, 6};
+    int stage = 0;
+    for (int i = 0; i < 4; i++) {
+        if (stages[i] <= kw) stage = stages[i];
+    }
+    return stage;
+}
+
+// Re-check on every poll whether the boiler draws its last step: the load
+// (grid + PV - battery) must have risen by at least half the step, averaged
+// over the last BOILER_AUTO_CONFIRM_POLLS polls. PV and battery changes cancel
+// out, house load changes are smoothed by the average and the wide tolerance.
+inline void boilerAutoCheckDraw(const BoilerAutoInput &in, BoilerAutoState &st) {
+    if (st.stepKW <= 0) return;
+
+    float load = in.gridKW + in.pvKW - in.batteryKW;
+    st.drawHist[st.drawCount % BOILER_AUTO_CONFIRM_POLLS] = load - st.loadAtChange;
+    st.drawCount++;
+
+    int n = (st.drawCount < BOILER_AUTO_CONFIRM_POLLS) ? st.drawCount : BOILER_AUTO_CONFIRM_POLLS;
+    float sum = 0;
+    for (int i = 0; i < n; i++) sum += st.drawHist[i];
+    st.drawConfirmed = (sum / n) >= st.stepKW * BOILER_AUTO_CONFIRM_FRACTION;
+}
+
+// Decision step for one poll, returns the stage to apply.
+// Limitation: the boiler's own thermostat is not visible. While the last
+// step is not seen on the grid, only confirmedStage counts as own draw and
+// no further step-up happens; holding a stage the boiler does not draw costs
+// nothing. A house load change of more than half a step that lasts several
+// polls can still be mistaken for the boiler.
+inline int boilerAutoStep(const BoilerAutoInput &in, BoilerAutoState &st) {
+    int current = (st.stage < 0) ? 0 : st.stage;
+
+    // No valid water temperature: the cap cannot be enforced, switch off
+    if (!in.tempValid) {
+        st.cheapActive = false;
+        return 0;
+    }
+
+    // Water temperature cap with hysteresis (overrides dwell times)
+    if (in.waterTempC >= BOILER_AUTO_MAX_TEMP_C) st.tempCapped = true;
+    else if (in.waterTempC < BOILER_AUTO_MAX_TEMP_C - BOILER_AUTO_TEMP_HYST_C) st.tempCapped = false;
+    if (st.tempCapped) {
+        st.cheapActive = false;
+        return 0;
+    }
+
+    // No valid power readings: hold the current stage, no fallback decisions
+    if (!in.powerValid) return current;
+
+    boilerAutoCheckDraw(in, st);
+
+    // Surplus available to the boiler: export + own draw, battery charge only once SOC is high,
+    // battery discharge always counts against it. Never more than PV actually produces.
+    float battery = in.batteryKW;
+    if (in.socPct < BOILER_AUTO_MIN_SOC && battery > 0.0f) battery = 0.0f;
+    float ownDraw = st.drawConfirmed ? current : st.confirmedStage;
+    float surplus = -in.gridKW + ownDraw + battery;
+    if (surplus > in.pvKW) surplus = in.pvKW;
+
+    int target = current;
+    if (surplus < current - BOILER_AUTO_MARGIN_KW) {
+        target = boilerStageForPower(surplus);
+    } else if (current == 0 || st.drawConfirmed) {
+        int up = boilerStageForPower(surplus - BOILER_AUTO_MARGIN_KW);
+        if (up > current) target = up;
+    }
+
+    // Fallback: no surplus, water getting cold -> heat in the cheapest Tibber hours
+    if (target == 0) {
+        if (!in.cheapHour) st.cheapActive = false;
+        else if (in.waterTempC < BOILER_AUTO_MIN_TEMP_C) st.cheapActive = true;
+        if (st.cheapActive) target = BOILER_AUTO_CHEAP_KW;
+    } else {
+        st.cheapActive = false;
+    }
+
+    // Minimum on/off dwell times (skipped while relays are unknown)
+    if (target != current && st.stage >= 0) {
+        unsigned long dwell = (current > 0) ? BOILER_AUTO_MIN_ON_MS : BOILER_AUTO_MIN_OFF_MS;
+        if (in.now - st.lastChange < dwell) target = current;
+    }
+    return target;
+}
+
+// Record a stage change after the relays were written successfully
+inline void boilerAutoCommit(BoilerAutoState &st, int target, const BoilerAutoInput &in) {
+    int previous = (st.stage < 0) ? 0 : st.stage;
+    if (target > previous) {
+        // Step-ups only start from a confirmed stage, measure against the load before it
+        st.confirmedStage = previous;
+        st.drawConfirmed = false;
+        st.loadAtChange = in.gridKW + in.pvKW - in.batteryKW;
+        st.stepKW = target - previous;
+        st.drawCount = 0;
+    } else if (target <= st.confirmedStage) {
+        st.confirmedStage = target;
+        st.drawConfirmed = true;
+        st.stepKW = 0;
+    } else {
+        // Still above the confirmed stage: keep the reference, check the smaller step
+        st.stepKW = target - st.confirmedStage;
+        st.drawCount = 0;
+    }
+    st.stage = target;
+    st.lastChange = in.now;
+}
+
+#endif
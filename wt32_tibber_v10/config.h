@@ -40,6 +40,11 @@
 #define WEATHER_CITY_ID    "2886242"  // Köln
 #define WEATHER_UPDATE_MS  1800000    // 30 minutes
 
+// ============================================================
+// JSON Arena (PSRAM, shared by all HTTP fetches)
+// ============================================================
+#define JSON_ARENA_SIZE  65536
+
 // ============================================================
 // Display
 // ============================================================
@@ -58,6 +63,13 @@
 #define TOUCH_TASK_STACK     12288
 #define MODBUS_LONG_INTERVAL  20000
 #define MODBUS_SHORT_INTERVAL 2000
+#define MODBUS_IDLE_INTERVAL  40000  // display off: control-relevant polling only
+
+// ============================================================
+// Power Governor (display off)
+// ============================================================
+#define CPU_FREQ_IDLE_MHZ    80     // lowest clock that keeps WiFi running
+                                    // (active profile restores the boot settings)
 
 // ============================================================
 // Watchdog
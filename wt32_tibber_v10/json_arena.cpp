@@ -0,0 +1,100 @@
+#include "json_arena.h"
+#include <esp_heap_caps.h>
+
+JsonArena jsonArena;
+
+static const size_t HDR = 8;  // block header (size), keeps payload 8-byte aligned
+static size_t sourcePeak[JSON_SRC_COUNT] = {0};
+static const char* const sourceNames[JSON_SRC_COUNT] = {
+    "Tibber", "VRM token", "VRM stats", "Weather", "Forecast"
+};
+
+static size_t align8(size_t n) { return (n + 7) & ~(size_t)7; }
+
+bool JsonArena::begin(size_t size) {
+    base_ = (uint8_t*)heap_caps_malloc(size, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+    if (!base_) {
+        // No PSRAM: holding a fixed internal block would starve TLS handshakes,
+        // so documents go through plain malloc/free like before
+        Serial.println("JSON arena: no PSRAM, using malloc");
+    }
+    size_ = base_ ? size : 0;
+    reset();
+    return base_ != nullptr;
+}
+
+void JsonArena::reset() {
+    used_ = 0;
+    peak_ = 0;
+    last_ = SIZE_MAX;
+}
+
+void* JsonArena::allocate(size_t size) {
+    if (!base_) return malloc(size);
+
+    size_t payload = align8(size);
+    if (used_ + HDR + payload > size_) {
+        Serial.printf("JSON arena full: need %u, used %u/%u\n",
+                      (unsigned)size, (unsigned)used_, (unsigned)size_);
+        return nullptr;
+    }
+    *(size_t*)(base_ + used_) = payload;
+    last_ = used_ + HDR;
+    used_ += HDR + payload;
+    if (used_ > peak_) peak_ = used_;
+    return base_ + last_;
+}
+
+void JsonArena::deallocate(void* ptr) {
+    if (!base_) { free(ptr); return; }
+
+    // Only the most recent block can be given back; the rest goes with reset()
+    if (ptr && (uint8_t*)ptr - base_ == (ptrdiff_t)last_) {
+        used_ = last_ - HDR;
+        last_ = SIZE_MAX;
+    }
+}
+
+void* JsonArena::reallocate(void* ptr, size_t newSize) {
+    if (!base_) return realloc(ptr, newSize);
+    if (!ptr) return allocate(newSize);
+
+    size_t offset = (uint8_t*)ptr - base_;
+    size_t oldSize = *(size_t*)(base_ + offset - HDR);
+    size_t payload = align8(newSize);
+
+    // Most recent block: grow or shrink in place
+    if (offset == last_) {
+        if (offset + payload > size_) return nullptr;
+        *(size_t*)(base_ + offset - HDR) = payload;
+        used_ = offset + payload;
+        if (used_ > peak_) peak_ = used_;
+        return ptr;
+    }
+
+    if (payload <= oldSize) return ptr;
+    void* moved = allocate(newSize);
+    if (moved) memcpy(moved, ptr, oldSize);
+    return moved;
+}
+
+JsonArenaScope::~JsonArenaScope() {
+    size_t peak = jsonArena.peak();
+    if (peak > sourcePeak[src_]) sourcePeak[src_] = peak;
+    jsonArena.reset();
+}
+
+void printJsonArenaStats() {
+    if (jsonArena.capacity() == 0) {
+        // malloc fallback does not track sizes, zeros would be misleading
+        Serial.println("JSON arena: no PSRAM, high-water marks not tracked");
+    } else {
+        Serial.printf("JSON arena: %u bytes, high-water marks:\n", (unsigned)jsonArena.capacity());
+        for (int i = 0; i < JSON_SRC_COUNT; i++) {
+            Serial.printf("  %-10s %6u bytes\n", sourceNames[i], (unsigned)sourcePeak[i]);
+        }
+    }
+    Serial.printf("Internal heap: free %u, largest block %u\n",
+                  (unsigned)heap_caps_get_free_size(MALLOC_CAP_INTERNAL),
+                  (unsigned)heap_caps_get_largest_free_block(MALLOC_CAP_INTERNAL));
+}
@@ -0,0 +1,52 @@
+#ifndef JSON_ARENA_H
+#define JSON_ARENA_H
+
+#include <ArduinoJson.h>
+
+// JSON sources sharing the arena (one fetch at a time, all from loop())
+enum JsonSource {
+    JSON_SRC_TIBBER,
+    JSON_SRC_VRM_TOKEN,
+    JSON_SRC_VRM_STATS,
+    JSON_SRC_WEATHER,
+    JSON_SRC_FORECAST,
+    JSON_SRC_COUNT
+};
+
+// Bump allocator over one preallocated PSRAM block, reset after each fetch.
+// Without PSRAM it falls back to plain malloc (no internal RAM is reserved).
+class JsonArena : public ArduinoJson::Allocator {
+public:
+    bool begin(size_t size);
+    void reset();
+    size_t used() const { return used_; }
+    size_t peak() const { return peak_; }
+    size_t capacity() const { return size_; }
+
+    void* allocate(size_t size) override;
+    void deallocate(void* ptr) override;
+    void* reallocate(void* ptr, size_t newSize) override;
+
+private:
+    uint8_t* base_ = nullptr;
+    size_t size_ = 0;
+    size_t used_ = 0;
+    size_t peak_ = 0;
+    size_t last_ = SIZE_MAX;  // offset of the most recent block (grows in place)
+};
+
+extern JsonArena jsonArena;
+
+// Declare before the JsonDocument: the document is destroyed first,
+// then the arena is reset and the high-water mark stored for the source.
+class JsonArenaScope {
+public:
+    explicit JsonArenaScope(JsonSource src) : src_(src) {}
+    ~JsonArenaScope();
+private:
+    JsonSource src_;
+};
+
+void printJsonArenaStats();
+
+#endif
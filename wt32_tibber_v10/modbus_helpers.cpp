@@ -20,11 +20,11 @@ bool connectModbusServer(IPAddress server, int maxRetries) {
     return false;
 }
 
-void readModbusData(IPAddress server, int reg, uint16_t &value, uint8_t unitID) {
+bool readModbusData(IPAddress server, int reg, uint16_t &value, uint8_t unitID) {
     if (!mb.isConnected(server)) {
         if (!mb.connect(server)) {
             Serial.printf("Read: Cannot connect to %s\n", server.toString().c_str());
-            return;
+            return false;
         }
     }
 
@@ -36,9 +36,10 @@ void readModbusData(IPAddress server, int reg, uint16_t &value, uint8_t unitID)
         vTaskDelay(pdMS_TO_TICKS(10));
         if (millis() - startMillis > 4000) {
             Serial.printf("Read timeout: reg %d on %s\n", reg, server.toString().c_str());
-            break;
+            return false;
         }
     }
+    return true;
 }
 
 bool writeModbusData(IPAddress server, int reg, uint16_t value, uint8_t unitID) {
@@ -6,7 +6,8 @@
 
 // Must be called with modbusMutex held
 bool writeModbusData(IPAddress server, int reg, uint16_t value, uint8_t unitID);
-void readModbusData(IPAddress server, int reg, uint16_t &value, uint8_t unitID = 1);
+// Returns false on connect failure or timeout (value left unchanged)
+bool readModbusData(IPAddress server, int reg, uint16_t &value, uint8_t unitID = 1);
 bool connectModbusServer(IPAddress server, int maxRetries = 2);
 
 extern ModbusTCP mb;
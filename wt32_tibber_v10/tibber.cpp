@@ -1,5 +1,6 @@
 #include "tibber.h"
 #include "config.h"
+#include "json_arena.h"
 #include <HTTPClient.h>
 #include <WiFi.h>
 #include <ArduinoJson.h>
@@ -32,6 +33,7 @@ void fetchTibberPrices() {
     }
 
     HTTPClient http;
+    http.useHTTP10(true);  // no chunked encoding, parse straight from the stream
     http.begin(TIBBER_API_URL);
     http.addHeader("Authorization", String("Bearer ") + TIBBER_API_TOKEN);
     http.addHeader("Content-Type", "application/json");
@@ -42,26 +44,19 @@ void fetchTibberPrices() {
     int httpCode = http.POST(payload);
 
     if (httpCode == 200) {
-        String response = http.getString();
-        
-        // Use DynamicJsonDocument to avoid stack overflow
-        DynamicJsonDocument* doc = new DynamicJsonDocument(4096);
-        if (!doc) {
-            Serial.println("Failed to allocate JSON document");
-            http.end();
-            return;
-        }
-        
-        DeserializationError error = deserializeJson(*doc, response);
+        // Document lives in the PSRAM arena, reset when the scope ends
+        JsonArenaScope arena(JSON_SRC_TIBBER);
+        JsonDocument doc(&jsonArena);
+
+        DeserializationError error = deserializeJson(doc, http.getStream());
         if (error) {
             Serial.printf("JSON parse error: %s\n", error.c_str());
-            delete doc;
             http.end();
             return;
         }
 
-        JsonArray todayPrices = (*doc)["data"]["viewer"]["homes"][0]["currentSubscription"]["priceInfo"]["today"].as<JsonArray>();
-        JsonArray tomorrowPrices = (*doc)["data"]["viewer"]["homes"][0]["currentSubscription"]["priceInfo"]["tomorrow"].as<JsonArray>();
+        JsonArray todayPrices = doc["data"]["viewer"]["homes"][0]["currentSubscription"]["priceInfo"]["today"].as<JsonArray>();
+        JsonArray tomorrowPrices = doc["data"]["viewer"]["homes"][0]["currentSubscription"]["priceInfo"]["tomorrow"].as<JsonArray>();
 
         int index = 0;
         for (JsonObject p : todayPrices) {
@@ -79,8 +74,6 @@ void fetchTibberPrices() {
 
         pricesLoaded = true;
         Serial.println("Tibber prices updated successfully.");
-        
-        delete doc;
     } else {
         Serial.printf("Tibber API error: HTTP %d\n", httpCode);
     }
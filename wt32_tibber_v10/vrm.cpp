@@ -1,5 +1,6 @@
 #include "vrm.h"
 #include "config.h"
+#include "json_arena.h"
 #include <HTTPClient.h>
 #include <WiFi.h>
 #include <ArduinoJson.h>
@@ -19,6 +20,7 @@ void fetchVrmToken() {
     if (WiFi.status() != WL_CONNECTED) return;
 
     HTTPClient http;
+    http.useHTTP10(true);
     http.begin("https://vrmapi.victronenergy.com/v2/auth/login");
     http.addHeader("Content-Type", "application/json");
     http.setTimeout(10000);
@@ -27,18 +29,15 @@ void fetchVrmToken() {
     int httpCode = http.POST(body);
 
     if (httpCode == 200) {
-        String response = http.getString();
-        DynamicJsonDocument* doc = new DynamicJsonDocument(2048);
-        if (doc) {
-            if (!deserializeJson(*doc, response)) {
-                const char* t = (*doc)["token"];
-                if (t) {
-                    vrmToken = String(t);
-                    tokenFetchedAt = millis();
-                    Serial.println("VRM token obtained.");
-                }
+        JsonArenaScope arena(JSON_SRC_VRM_TOKEN);
+        JsonDocument doc(&jsonArena);
+        if (!deserializeJson(doc, http.getStream())) {
+            const char* t = doc["token"];
+            if (t) {
+                vrmToken = String(t);
+                tokenFetchedAt = millis();
+                Serial.println("VRM token obtained.");
             }
-            delete doc;
         }
     } else {
         Serial.printf("VRM login error: HTTP %d\n", httpCode);
@@ -77,43 +76,41 @@ void fetchVrmDailyStats() {
                  + "&attributeCodes[]=grid_history_from";
 
     HTTPClient http;
+    http.useHTTP10(true);
     http.begin(url);
     http.addHeader("X-Authorization", "Bearer " + vrmToken);
     http.setTimeout(10000);
 
     int httpCode = http.GET();
     if (httpCode == 200) {
-        String response = http.getString();
-        DynamicJsonDocument* doc = new DynamicJsonDocument(8192);
-        if (doc) {
-            if (!deserializeJson(*doc, response)) {
-                // Sum up hourly values
-                float solar = 0, consumption = 0, gridFrom = 0, gridTo = 0;
-
-                JsonArray solarArr = (*doc)["records"]["total_solar_yield"];
-                for (JsonArray entry : solarArr) solar += entry[1].as<float>();
-
-                JsonArray consArr = (*doc)["records"]["total_consumption"];
-                for (JsonArray entry : consArr) consumption += entry[1].as<float>();
-
-                JsonArray fromArr = (*doc)["records"]["grid_history_from"];
-                for (JsonArray entry : fromArr) gridFrom += entry[1].as<float>();
-
-                JsonArray toArr = (*doc)["records"]["grid_history_to"];
-                for (JsonArray entry : toArr) gridTo += entry[1].as<float>();
-
-                vrmSolarYield = solar;
-                vrmConsumption = consumption;
-                vrmGridToConsumer = gridFrom;
-                vrmGridToGrid = gridTo;
-                vrmSelfConsumption = (solar > 0.1) ? ((solar - gridTo) / solar * 100.0) : 0.0;
-                vrmNetGrid = gridFrom - gridTo;  // positive = net import, negative = net export
-                vrmDataLoaded = true;
-
-                Serial.printf("VRM: Solar=%.1f Cons=%.1f From=%.1f To=%.1f Self=%.0f%%\n",
-                              solar, consumption, gridFrom, gridTo, vrmSelfConsumption);
-            }
-            delete doc;
+        JsonArenaScope arena(JSON_SRC_VRM_STATS);
+        JsonDocument doc(&jsonArena);
+        if (!deserializeJson(doc, http.getStream())) {
+            // Sum up hourly values
+            float solar = 0, consumption = 0, gridFrom = 0, gridTo = 0;
+
+            JsonArray solarArr = doc["records"]["total_solar_yield"];
+            for (JsonArray entry : solarArr) solar += entry[1].as<float>();
+
+            JsonArray consArr = doc["records"]["total_consumption"];
+            for (JsonArray entry : consArr) consumption += entry[1].as<float>();
+
+            JsonArray fromArr = doc["records"]["grid_history_from"];
+            for (JsonArray entry : fromArr) gridFrom += entry[1].as<float>();
+
+            JsonArray toArr = doc["records"]["grid_history_to"];
+            for (JsonArray entry : toArr) gridTo += entry[1].as<float>();
+
+            vrmSolarYield = solar;
+            vrmConsumption = consumption;
+            vrmGridToConsumer = gridFrom;
+            vrmGridToGrid = gridTo;
+            vrmSelfConsumption = (solar > 0.1) ? ((solar - gridTo) / solar * 100.0) : 0.0;
+            vrmNetGrid = gridFrom - gridTo;  // positive = net import, negative = net export
+            vrmDataLoaded = true;
+
+            Serial.printf("VRM: Solar=%.1f Cons=%.1f From=%.1f To=%.1f Self=%.0f%%\n",
+                          solar, consumption, gridFrom, gridTo, vrmSelfConsumption);
         }
     } else if (httpCode == 401) {
         Serial.println("VRM token expired, refreshing...");
@@ -15,6 +15,7 @@
 #include "tibber.h"
 #include "boiler.h"
 #include "vrm.h"
+#include "json_arena.h"
 
 // Dark Theme Colors (RGB565)
 #define BG_DARK    0x18E3   // rgb(25,25,30)
@@ -246,6 +247,15 @@ static unsigned long lastTouchTime = 0;
 const unsigned long debounceDelay = 200;
 static volatile bool immediateModbusRequest = false;
 
+// ============================================================
+// Power governor state
+// ============================================================
+static TaskHandle_t modbusTaskHandle = NULL;
+static volatile unsigned long wakeRequestedAt = 0;  // millis() of display wake, 0 = none pending
+static unsigned long displayOffAt = 0;
+static uint32_t bootCpuFreqMhz = 0;                 // active profile, saved in setup()
+static wifi_ps_type_t bootWifiSleep = WIFI_PS_MIN_MODEM;
+
 // ============================================================
 // Forward declarations
 // ============================================================
@@ -284,14 +294,15 @@ void fetchWeather() {
     String url = String("http://api.openweathermap.org/data/2.5/weather?id=")
                  + WEATHER_CITY_ID + "&appid=" + WEATHER_API_KEY
                  + "&units=metric&lang=de";
+    http.useHTTP10(true);
     http.begin(url);
     http.setTimeout(8000);
 
     int httpCode = http.GET();
     if (httpCode == 200) {
-        String response = http.getString();
-        JsonDocument doc;
-        auto error = deserializeJson(doc, response);
+        JsonArenaScope arena(JSON_SRC_WEATHER);
+        JsonDocument doc(&jsonArena);
+        auto error = deserializeJson(doc, http.getStream());
         if (!error) {
             weatherTemp = doc["main"]["temp"];
             weatherId = doc["weather"][0]["id"];
@@ -315,36 +326,34 @@ void fetchForecast() {
     String url = String("http://api.openweathermap.org/data/2.5/forecast?id=")
                  + WEATHER_CITY_ID + "&appid=" + WEATHER_API_KEY
                  + "&units=metric&lang=de&cnt=40";
+    http.useHTTP10(true);
     http.begin(url);
     http.setTimeout(10000);
 
     int httpCode = http.GET();
     if (httpCode == 200) {
-        String response = http.getString();
-        DynamicJsonDocument* doc = new DynamicJsonDocument(16384);
-        if (doc) {
-            if (!deserializeJson(*doc, response)) {
-                JsonArray list = (*doc)["list"];
-                forecastCount = 0;
-                for (JsonObject entry : list) {
-                    if (forecastCount >= FORECAST_MAX) break;
-                    forecastTemp[forecastCount] = entry["main"]["temp"];
-                    forecastId[forecastCount] = entry["weather"][0]["id"];
-                    // Rain: "rain"."3h" or 0
-                    forecastRain[forecastCount] = entry["rain"]["3h"] | 0.0f;
-                    // Parse timestamp for hour/day
-                    time_t dt = (time_t)entry["dt"].as<long>();
-                    struct tm* ti = localtime(&dt);
-                    if (ti) {
-                        forecastHour[forecastCount] = ti->tm_hour;
-                        forecastDay[forecastCount] = ti->tm_mday;
-                    }
-                    forecastCount++;
+        JsonArenaScope arena(JSON_SRC_FORECAST);
+        JsonDocument doc(&jsonArena);
+        if (!deserializeJson(doc, http.getStream())) {
+            JsonArray list = doc["list"];
+            forecastCount = 0;
+            for (JsonObject entry : list) {
+                if (forecastCount >= FORECAST_MAX) break;
+                forecastTemp[forecastCount] = entry["main"]["temp"];
+                forecastId[forecastCount] = entry["weather"][0]["id"];
+                // Rain: "rain"."3h" or 0
+                forecastRain[forecastCount] = entry["rain"]["3h"] | 0.0f;
+                // Parse timestamp for hour/day
+                time_t dt = (time_t)entry["dt"].as<long>();
+                struct tm* ti = localtime(&dt);
+                if (ti) {
+                    forecastHour[forecastCount] = ti->tm_hour;
+                    forecastDay[forecastCount] = ti->tm_mday;
                 }
-                forecastLoaded = true;
-                Serial.printf("Forecast: %d entries loaded\n", forecastCount);
+                forecastCount++;
             }
-            delete doc;
+            forecastLoaded = true;
+            Serial.printf("Forecast: %d entries loaded\n", forecastCount);
         }
     } else {
         Serial.printf("Forecast API error: HTTP %d\n", httpCode);
@@ -451,7 +460,7 @@ void drawBoilerSwitch() {
     lcd.drawRoundRect(BOILER_SWITCH_X, BOILER_SWITCH_Y, BOILER_SWITCH_W, BOILER_SWITCH_H, R, CARD_BORDER);
     String modeText;
     switch (boilerMode) {
-        case 0: modeText = "Auto"; break;
+        case 0: modeText = boilerAutoStage ? "Auto " + String(boilerAutoStage) + "kW" : "Auto"; break;
         case 2: modeText = "2kW"; break;
         case 4: modeText = "4kW"; break;
         case 6: modeText = "6kW"; break;
@@ -1119,6 +1128,7 @@ void displayData() {
         drawWeather();
     } else if (currentTab == 2) {
         lcd.fillRect(0, 0, TAB1_BUTTON_X - 1, TFT_HEIGHT, BG_DARK);
+        drawBoilerSwitch();
     } else if (currentTab == 3) {
         lcd.fillRect(0, 0, TAB1_BUTTON_X - 1, TFT_HEIGHT, BG_DARK);
         drawTibberPriceGraph(tibberPrices, 48);
@@ -1217,23 +1227,41 @@ void adjustBrightness(int level) {
     lcd.setBrightness(brightnessLevel);
 }
 
+// Display off: lower CPU clock and let the modem sleep between polls
+void setPowerProfile(bool idle) {
+    if (idle) {
+        setCpuFrequencyMhz(CPU_FREQ_IDLE_MHZ);
+        WiFi.setSleep(WIFI_PS_MAX_MODEM);
+    } else {
+        setCpuFrequencyMhz(bootCpuFreqMhz);
+        WiFi.setSleep(bootWifiSleep);
+    }
+    Serial.printf("Power profile: %s, CPU %lu MHz\n", idle ? "idle" : "active", (unsigned long)getCpuFrequencyMhz());
+}
+
 void turnOffDisplay() {
     if (displayOn) {
         lcd.setBrightness(0);
         displayOn = false;
+        displayOffAt = millis();
+        setPowerProfile(true);
         Serial.println("Display off (inactivity).");
     }
 }
 
 void turnOnDisplay() {
     if (!displayOn) {
+        setPowerProfile(false);
         adjustBrightness(brightnessLevel);
         displayOn = true;
         if (LCD_LOCK()) {
             switchTab(1);
             LCD_UNLOCK();
         }
-        Serial.println("Display on (touch).");
+        // Catch up immediately: wake modbusTask instead of waiting for its interval
+        wakeRequestedAt = millis();
+        if (modbusTaskHandle) xTaskNotifyGive(modbusTaskHandle);
+        Serial.printf("Display on (touch) after %lu s idle.\n", (millis() - displayOffAt) / 1000);
     }
 }
 
@@ -1254,6 +1282,9 @@ void modbusTask(void *parameter) {
     while (true) {
         esp_task_wdt_reset();
 
+        // Display off: only read what the SOC threshold and boiler automation need
+        bool fullPoll = displayOn;
+
         // --- EVCS ---
         if (!evcsConnected) {
             xSemaphoreTake(modbusMutex, portMAX_DELAY);
@@ -1262,11 +1293,15 @@ void modbusTask(void *parameter) {
         }
         if (evcsConnected) {
             xSemaphoreTake(modbusMutex, portMAX_DELAY);
-            readModbusData(remoteEVCS, MANUAL_MODE_PHASE_REG, manualModePhase);
-            readModbusData(remoteEVCS, CHARGE_MODE_REG, chargeMode);
-            readModbusData(remoteEVCS, CHARGE_POWER_REG, chargePower);
+            if (fullPoll) {
+                readModbusData(remoteEVCS, MANUAL_MODE_PHASE_REG, manualModePhase);
+                readModbusData(remoteEVCS, CHARGE_MODE_REG, chargeMode);
+                readModbusData(remoteEVCS, CHARGE_POWER_REG, chargePower);
+            }
             readModbusData(remoteEVCS, START_STOP_CHARGING_REG, startStopCharging);
-            readModbusData(remoteEVCS, CHARGER_STATUS_REG, chargerStatus);
+            if (fullPoll) {
+                readModbusData(remoteEVCS, CHARGER_STATUS_REG, chargerStatus);
+            }
             xSemaphoreGive(modbusMutex);
         }
 
@@ -1281,8 +1316,10 @@ void modbusTask(void *parameter) {
         if (socConnected) {
             xSemaphoreTake(modbusMutex, portMAX_DELAY);
             readModbusData(remoteSOC, SOC_REG, socValue);
-            readModbusData(remoteSOC, TIMESTAMP_HIGH_REG, timestampHigh);
-            readModbusData(remoteSOC, TIMESTAMP_LOW_REG, timestampLow);
+            if (fullPoll) {
+                readModbusData(remoteSOC, TIMESTAMP_HIGH_REG, timestampHigh);
+                readModbusData(remoteSOC, TIMESTAMP_LOW_REG, timestampLow);
+            }
             xSemaphoreGive(modbusMutex);
 
             // SOC threshold check
@@ -1301,34 +1338,52 @@ void modbusTask(void *parameter) {
             cerboConnected = connectModbusServer(remoteCERBO, 2);
             xSemaphoreGive(modbusMutex);
         }
+        // Track which of this cycle's reads succeeded, the boiler automation must not
+        // act on values left over from an earlier cycle
+        bool powerValid = false, tempValid = false;
         if (cerboConnected) {
             xSemaphoreTake(modbusMutex, portMAX_DELAY);
-            readModbusData(remoteCERBO, PYLONTECH_SOC_REG, PylontechSOC, CERBO_UNIT_ID_VAL);
-            readModbusData(remoteCERBO, WATER_TEMP_REG, waterTemperature, CERBO_UNIT_ID_TEMP_VAL);
-            readModbusData(remoteCERBO, 842, batteryPower, CERBO_UNIT_ID_VAL);
-            readModbusData(remoteCERBO, DC_PV_POWER_REG, dcPvPower, CERBO_UNIT_ID_VAL);
+            powerValid = readModbusData(remoteCERBO, PYLONTECH_SOC_REG, PylontechSOC, CERBO_UNIT_ID_VAL);
+            tempValid = readModbusData(remoteCERBO, WATER_TEMP_REG, waterTemperature, CERBO_UNIT_ID_TEMP_VAL);
+            powerValid &= readModbusData(remoteCERBO, 842, batteryPower, CERBO_UNIT_ID_VAL);
+            powerValid &= readModbusData(remoteCERBO, DC_PV_POWER_REG, dcPvPower, CERBO_UNIT_ID_VAL);
             for (int i = 0; i < 3; i++) {
-                readModbusData(remoteCERBO, AC_PV_POWER_REGS[i], acPvPower[i], CERBO_UNIT_ID_VAL);
+                powerValid &= readModbusData(remoteCERBO, AC_PV_POWER_REGS[i], acPvPower[i], CERBO_UNIT_ID_VAL);
             }
-            readModbusData(remoteCERBO, GRID_PHASE1_REG, rawgridPhase1, CERBO_UNIT_ID_VAL);
-            readModbusData(remoteCERBO, GRID_PHASE2_REG, rawgridPhase2, CERBO_UNIT_ID_VAL);
-            readModbusData(remoteCERBO, GRID_PHASE3_REG, rawgridPhase3, CERBO_UNIT_ID_VAL);
+            powerValid &= readModbusData(remoteCERBO, GRID_PHASE1_REG, rawgridPhase1, CERBO_UNIT_ID_VAL);
+            powerValid &= readModbusData(remoteCERBO, GRID_PHASE2_REG, rawgridPhase2, CERBO_UNIT_ID_VAL);
+            powerValid &= readModbusData(remoteCERBO, GRID_PHASE3_REG, rawgridPhase3, CERBO_UNIT_ID_VAL);
 
             totalGridPowerKW = ((int16_t)rawgridPhase1 + (int16_t)rawgridPhase2 + (int16_t)rawgridPhase3) / 1000.0;
             xSemaphoreGive(modbusMutex);
         }
 
-        // Update display (with LCD mutex)
-        if (displayOn) {
+        esp_task_wdt_reset();
+
+        // Boiler auto mode (takes modbusMutex internally)
+        runBoilerAutomation(powerValid, tempValid);
+
+        // Update display (with LCD mutex). A partial poll started while the display
+        // was off has stale EVCS fields; the notified catch-up poll draws instead.
+        if (displayOn && fullPoll) {
             if (LCD_LOCK()) {
                 displayData();
                 LCD_UNLOCK();
             }
+            // First full poll after wake: report wake-to-fresh-frame latency
+            if (wakeRequestedAt) {
+                Serial.printf("Wake: fresh frame after %lu ms\n", millis() - wakeRequestedAt);
+                wakeRequestedAt = 0;
+            }
         }
 
-        int interval = immediateModbusRequest ? MODBUS_SHORT_INTERVAL : MODBUS_LONG_INTERVAL;
+        int interval = !displayOn ? MODBUS_IDLE_INTERVAL
+                     : immediateModbusRequest ? MODBUS_SHORT_INTERVAL : MODBUS_LONG_INTERVAL;
         immediateModbusRequest = false;
-        vTaskDelay(pdMS_TO_TICKS(interval));
+        // Feed right before the wait, the reads above can take well over a minute in total.
+        // Returns early when turnOnDisplay() notifies us.
+        esp_task_wdt_reset();
+        ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(interval));
     }
 }
 
@@ -1463,6 +1518,10 @@ void setup() {
     // WiFi
     connectToWiFi();
 
+    // Power governor restores these when the display wakes
+    bootCpuFreqMhz = getCpuFrequencyMhz();
+    bootWifiSleep = WiFi.getSleep();
+
     // NTP
     configTzTime("CET-1CEST,M3.5.0,M10.5.0/3", "pool.ntp.org", "time.nist.gov");
     struct tm timeinfo;
@@ -1492,6 +1551,9 @@ void setup() {
     autoAdjustBrightness();
     drawWiFiIcon(WiFi.status() == WL_CONNECTED);
 
+    // JSON arena (PSRAM) before the first fetch
+    jsonArena.begin(JSON_ARENA_SIZE);
+
     // Tibber
     fetchTibberPrices();
     fetchWeather();
@@ -1508,7 +1570,7 @@ void setup() {
     mb.client();
 
     // Start tasks with proper stack sizes
-    xTaskCreatePinnedToCore(modbusTask, "Modbus", MODBUS_TASK_STACK, NULL, 1, NULL, 0);
+    xTaskCreatePinnedToCore(modbusTask, "Modbus", MODBUS_TASK_STACK, NULL, 1, &modbusTaskHandle, 0);
     xTaskCreatePinnedToCore(modbusWriteTask, "ModbusWr", MODBUS_WRITE_STACK, NULL, 2, NULL, 0);
     xTaskCreatePinnedToCore(touchTask, "Touch", TOUCH_TASK_STACK, NULL, 2, NULL, 1);
 
@@ -1557,14 +1619,15 @@ void loop() {
             drawTibberPrice();
             LCD_UNLOCK();
         }
+        printJsonArenaStats();
     }
 
     // Daily price fetch
     checkAndFetchTibberPrices();
 
-    // VRM update every 5 minutes
+    // VRM update every 5 minutes (suspended while display is off, stale timer catches up on wake)
     static unsigned long lastVrmFetch = 0;
-    if (millis() - lastVrmFetch > VRM_UPDATE_MS) {
+    if (displayOn && millis() - lastVrmFetch > VRM_UPDATE_MS) {
         lastVrmFetch = millis();
         fetchVrmDailyStats();
         if (displayOn && LCD_LOCK()) {
@@ -1573,8 +1636,8 @@ void loop() {
         }
     }
 
-    // Weather update every 30 minutes
-    if (millis() - lastWeatherFetch > WEATHER_UPDATE_MS) {
+    // Weather update every 30 minutes (suspended while display is off)
+    if (displayOn && millis() - lastWeatherFetch > WEATHER_UPDATE_MS) {
         fetchWeather();
         fetchForecast();
         if (displayOn && LCD_LOCK()) {